@@ -6,6 +6,10 @@
 #include <stddef.h>
 #include "esp_assert.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 // IEEE 802.15.4 FCF field value enumerations
 typedef enum {
     IEEE802154_FRAME_TYPE_BEACON    = 0x0, // Beacon frame
@@ -74,4 +78,8 @@ bool ieee802154_frame_parse(const uint8_t *data, ieee802154_frame_t *frame, bool
 size_t ieee802154_frame_build(const ieee802154_frame_t *frame, uint8_t *buffer, bool verbose);
 const char* ieee802154_frame_type_to_str(uint8_t frameType);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // IEEE802154_FRAME_H
\ No newline at end of file
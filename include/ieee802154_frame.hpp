@@ -0,0 +1,238 @@
+#ifndef IEEE802154_FRAME_HPP
+#define IEEE802154_FRAME_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include "ieee802154_frame.h"
+
+// Header-only C++ codec for fixed IEEE 802.15.4 header shapes.
+// Each Frame<> specialization knows its field offsets at compile time, so
+// parse/build reduce to fixed-size loads and stores. Buffers use the same
+// layout as ieee802154_frame_parse/ieee802154_frame_build (length byte at
+// the start, 0x00 at the end) and fill/read the same ieee802154_frame_t.
+namespace ieee802154 {
+
+namespace detail {
+
+// Address length in bytes for a given addressing mode
+constexpr size_t addrLen(ieee802154_addr_mode_t mode) {
+    return mode == IEEE802154_ADDR_MODE_SHORT ? 2 :
+           mode == IEEE802154_ADDR_MODE_EXTENDED ? IEEE802154_MAX_ADDR_LEN : 0;
+}
+
+// FCF bits that select the header shape
+constexpr uint16_t FCF_PAN_ID_COMPRESSION = 1u << 6;
+constexpr uint16_t FCF_SEQ_SUPPRESSION    = 1u << 8;
+constexpr uint16_t FCF_DEST_ADDR_SHIFT    = 10;
+constexpr uint16_t FCF_SRC_ADDR_SHIFT     = 14;
+constexpr uint16_t FCF_SHAPE_MASK = FCF_PAN_ID_COMPRESSION | FCF_SEQ_SUPPRESSION |
+                                    (0x3u << FCF_DEST_ADDR_SHIFT) | (0x3u << FCF_SRC_ADDR_SHIFT);
+
+// Raw FCF as transmitted (little-endian)
+inline uint16_t fcfRaw(const uint8_t *bytes) {
+    return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+inline uint16_t fcfRaw(const ieee802154_fcf_t &fcf) {
+    uint8_t bytes[IEEE802154_FCF_SIZE];
+    memcpy(bytes, &fcf, IEEE802154_FCF_SIZE);
+    return fcfRaw(bytes);
+}
+
+inline uint16_t loadLe16(const uint8_t *p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline void storeLe16(uint8_t *p, uint16_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+} // namespace detail
+
+// Fixed header shape: addressing modes, PAN ID compression and sequence
+// number suppression. Offsets are relative to the start of the buffer,
+// i.e. they include the leading length byte.
+template <ieee802154_addr_mode_t DestMode, ieee802154_addr_mode_t SrcMode, bool PanComp, bool SeqSupp>
+struct Frame {
+    static_assert(DestMode != IEEE802154_ADDR_MODE_RESERVED, "Reserved destination address mode has no fixed layout");
+    static_assert(SrcMode != IEEE802154_ADDR_MODE_RESERVED, "Reserved source address mode has no fixed layout");
+
+    static constexpr bool hasDestAddr = (DestMode != IEEE802154_ADDR_MODE_NONE);
+    static constexpr bool hasSrcAddr = (SrcMode != IEEE802154_ADDR_MODE_NONE);
+    static constexpr bool hasSrcPanId = hasSrcAddr && !PanComp;
+
+    static constexpr size_t destAddrLen = detail::addrLen(DestMode);
+    static constexpr size_t srcAddrLen = detail::addrLen(SrcMode);
+
+    static constexpr size_t fcfOffset = 1; // After length byte
+    static constexpr size_t seqOffset = fcfOffset + IEEE802154_FCF_SIZE;
+    static constexpr size_t destPanIdOffset = seqOffset + (SeqSupp ? 0 : 1);
+    static constexpr size_t destAddrOffset = destPanIdOffset + (hasDestAddr ? IEEE802154_PAN_ID_LEN : 0);
+    static constexpr size_t srcPanIdOffset = destAddrOffset + destAddrLen;
+    static constexpr size_t srcAddrOffset = srcPanIdOffset + (hasSrcPanId ? IEEE802154_PAN_ID_LEN : 0);
+    static constexpr size_t payloadOffset = srcAddrOffset + srcAddrLen;
+
+    // MAC header length (FCF through source address)
+    static constexpr size_t headerLen = payloadOffset - fcfOffset;
+
+    // FCF shape bits identifying this specialization
+    static constexpr uint16_t fcfShape =
+        (PanComp ? detail::FCF_PAN_ID_COMPRESSION : 0) |
+        (SeqSupp ? detail::FCF_SEQ_SUPPRESSION : 0) |
+        (static_cast<uint16_t>(DestMode) << detail::FCF_DEST_ADDR_SHIFT) |
+        (static_cast<uint16_t>(SrcMode) << detail::FCF_SRC_ADDR_SHIFT);
+
+    static_assert((fcfShape & ~detail::FCF_SHAPE_MASK) == 0, "FCF shape bits out of range");
+    static_assert(headerLen >= IEEE802154_FCF_SIZE && headerLen <= 23, "MAC header length out of range");
+    static_assert(destAddrLen <= IEEE802154_MAX_ADDR_LEN && srcAddrLen <= IEEE802154_MAX_ADDR_LEN,
+                  "Address does not fit ieee802154_frame_t");
+
+    static bool matches(uint16_t fcf) {
+        return (fcf & detail::FCF_SHAPE_MASK) == fcfShape;
+    }
+
+    static bool matches(const ieee802154_fcf_t &fcf) {
+        return matches(detail::fcfRaw(fcf));
+    }
+
+    // Parse a frame of this shape. The FCF is assumed to match (see matches()).
+    static bool parse(const uint8_t *data, ieee802154_frame_t *frame) {
+        if (!data || !frame) {
+            return false;
+        }
+
+        // Frame length excluding trailing 0x00, same convention as ieee802154_frame_parse
+        size_t frame_len = data[0] - 1;
+        if (payloadOffset > frame_len) {
+            return false;
+        }
+
+        memcpy(&frame->fcf, data + fcfOffset, IEEE802154_FCF_SIZE);
+        frame->sequenceNumber = SeqSupp ? 0 : data[seqOffset];
+        frame->destPanId = hasDestAddr ? detail::loadLe16(data + destPanIdOffset) : 0;
+
+        frame->destAddrLen = destAddrLen;
+        memset(frame->destAddress, 0, IEEE802154_MAX_ADDR_LEN);
+        memcpy(frame->destAddress, data + destAddrOffset, destAddrLen);
+
+        if (hasSrcPanId) {
+            frame->srcPanId = detail::loadLe16(data + srcPanIdOffset);
+        } else {
+            frame->srcPanId = hasSrcAddr ? frame->destPanId : 0; // PAN ID compression
+        }
+
+        frame->srcAddrLen = srcAddrLen;
+        memset(frame->srcAddress, 0, IEEE802154_MAX_ADDR_LEN);
+        memcpy(frame->srcAddress, data + srcAddrOffset, srcAddrLen);
+
+        frame->payloadLen = frame_len - payloadOffset;
+        frame->payload = (frame->payloadLen > 0) ? const_cast<uint8_t *>(data + payloadOffset) : nullptr;
+        return true;
+    }
+
+    // Build a frame of this shape. The shape bits of frame->fcf are forced to
+    // this specialization; all other FCF bits are taken from frame->fcf.
+    static size_t build(const ieee802154_frame_t *frame, uint8_t *buffer) {
+        if (!frame || !buffer) {
+            return 0;
+        }
+
+        uint16_t fcf = (detail::fcfRaw(frame->fcf) & ~detail::FCF_SHAPE_MASK) | fcfShape;
+        detail::storeLe16(buffer + fcfOffset, fcf);
+        if (!SeqSupp) {
+            buffer[seqOffset] = frame->sequenceNumber;
+        }
+        if (hasDestAddr) {
+            detail::storeLe16(buffer + destPanIdOffset, frame->destPanId);
+        }
+        memcpy(buffer + destAddrOffset, frame->destAddress, destAddrLen);
+        if (hasSrcPanId) {
+            detail::storeLe16(buffer + srcPanIdOffset, frame->srcPanId);
+        }
+        memcpy(buffer + srcAddrOffset, frame->srcAddress, srcAddrLen);
+
+        size_t offset = payloadOffset;
+        if (frame->payloadLen > 0 && frame->payload) {
+            memcpy(buffer + offset, frame->payload, frame->payloadLen);
+            offset += frame->payloadLen;
+        }
+
+        // Trailing 0x00 and length byte (total length including both)
+        buffer[offset] = 0x00;
+        offset += 1;
+        buffer[0] = offset;
+        return offset;
+    }
+};
+
+// Common shapes (sequence number present, PAN ID compression when both addresses are present)
+using ShortShortCompressed = Frame<IEEE802154_ADDR_MODE_SHORT, IEEE802154_ADDR_MODE_SHORT, true, false>;
+using ShortExtendedCompressed = Frame<IEEE802154_ADDR_MODE_SHORT, IEEE802154_ADDR_MODE_EXTENDED, true, false>;
+using ExtendedExtendedCompressed = Frame<IEEE802154_ADDR_MODE_EXTENDED, IEEE802154_ADDR_MODE_EXTENDED, true, false>;
+using NoAddr = Frame<IEEE802154_ADDR_MODE_NONE, IEEE802154_ADDR_MODE_NONE, false, false>;
+
+static_assert(ShortShortCompressed::headerLen == 9, "FCF(2) + Seq(1) + DestPAN(2) + DestAddr(2) + SrcAddr(2)");
+static_assert(ShortExtendedCompressed::headerLen == 15, "FCF(2) + Seq(1) + DestPAN(2) + DestAddr(2) + SrcAddr(8)");
+static_assert(ExtendedExtendedCompressed::headerLen == 21, "FCF(2) + Seq(1) + DestPAN(2) + DestAddr(8) + SrcAddr(8)");
+static_assert(NoAddr::headerLen == 3, "FCF(2) + Seq(1)");
+
+// Runtime dispatcher: tries each shape in order and falls back to the
+// generic C implementation when none matches or verbose logging is requested.
+template <typename... Frames>
+struct Codec {
+    static bool parse(const uint8_t *data, ieee802154_frame_t *frame, bool verbose = false) {
+        if (!data || !frame) {
+            return false;
+        }
+        if (!verbose && data[0] > IEEE802154_FCF_SIZE + 1) {
+            uint16_t fcf = detail::fcfRaw(data + 1);
+            bool result = false;
+            if ((tryParse<Frames>(fcf, data, frame, &result) || ...)) {
+                return result;
+            }
+        }
+        return ieee802154_frame_parse(data, frame, verbose);
+    }
+
+    static size_t build(const ieee802154_frame_t *frame, uint8_t *buffer, bool verbose = false) {
+        if (!frame || !buffer) {
+            return ieee802154_frame_build(frame, buffer, verbose);
+        }
+        if (!verbose) {
+            uint16_t fcf = detail::fcfRaw(frame->fcf);
+            size_t len = 0;
+            if ((tryBuild<Frames>(fcf, frame, buffer, &len) || ...)) {
+                return len;
+            }
+        }
+        return ieee802154_frame_build(frame, buffer, verbose);
+    }
+
+private:
+    // Returns true if F handled the frame, with its result stored in *result
+    template <typename F>
+    static bool tryParse(uint16_t fcf, const uint8_t *data, ieee802154_frame_t *frame, bool *result) {
+        if (!F::matches(fcf)) {
+            return false;
+        }
+        *result = F::parse(data, frame);
+        return true;
+    }
+
+    template <typename F>
+    static bool tryBuild(uint16_t fcf, const ieee802154_frame_t *frame, uint8_t *buffer, size_t *len) {
+        if (!F::matches(fcf)) {
+            return false;
+        }
+        *len = F::build(frame, buffer);
+        return true;
+    }
+};
+
+using DefaultCodec = Codec<ShortShortCompressed, ShortExtendedCompressed, ExtendedExtendedCompressed, NoAddr>;
+
+} // namespace ieee802154
+
+#endif // IEEE802154_FRAME_HPP
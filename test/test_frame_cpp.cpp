@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <unity.h>
+
+#include <esp_log.h>
+
+#include "ieee802154_frame.hpp"
+
+// Compile-time layout checks
+static_assert(ieee802154::ShortShortCompressed::destAddrOffset == 6, "Dest address follows length, FCF, seq and dest PAN");
+static_assert(ieee802154::ShortShortCompressed::payloadOffset == 10, "Payload follows 9-byte header");
+static_assert(ieee802154::ShortShortCompressed::fcfShape == 0x8840, "Short/short with PAN ID compression");
+
+// Test case: Parse a data frame with the fixed short/short specialization
+TEST_CASE("C++ parse a short/short data frame", "[cpp]") {
+    uint8_t raw_frame[] = {
+        0x11,       // Length (17 bytes)
+        0x41, 0x88, // FCF: Data, short addresses, 2003, PAN ID compression
+        0xdb,       // Sequence Number
+        0xe7, 0x00, // Dest PAN ID
+        0xff, 0xff, // Dest Address
+        0x96, 0xf0, // Src Address
+        0xc9, 0x80, 0x00, 0x00, 0x00, 0xb7, // Payload
+        0x00        // Trailing 0x00
+    };
+    ieee802154_frame_t frame = {};
+    ieee802154_frame_t expected = {};
+
+    TEST_ASSERT_TRUE(ieee802154::ShortShortCompressed::matches(ieee802154::detail::fcfRaw(raw_frame + 1)));
+    TEST_ASSERT_TRUE(ieee802154::ShortShortCompressed::parse(raw_frame, &frame));
+    TEST_ASSERT_TRUE(ieee802154_frame_parse(raw_frame, &expected, false));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &frame, sizeof(frame));
+}
+
+// Test case: Dispatcher falls back to the C path for unlisted shapes
+TEST_CASE("C++ dispatcher falls back to generic parser", "[cpp]") {
+    uint8_t raw_frame[] = {
+        0x0d,       // Length (13 bytes)
+        0x01, 0x88, // FCF: Data, short addresses, 2003, no PAN ID compression
+        0x10,       // Sequence Number
+        0x34, 0x12, // Dest PAN ID
+        0x56, 0x78, // Dest Address
+        0xcd, 0xab, // Src PAN ID
+        0x9a, 0xbc, // Src Address
+        0x00        // Trailing 0x00
+    };
+    ieee802154_frame_t frame = {};
+
+    TEST_ASSERT_TRUE(ieee802154::DefaultCodec::parse(raw_frame, &frame));
+    TEST_ASSERT_EQUAL(0x1234, frame.destPanId);
+    TEST_ASSERT_EQUAL(0xabcd, frame.srcPanId);
+    TEST_ASSERT_EQUAL(0, frame.payloadLen);
+}
+
+// Test case: Parse an invalid frame (too short) through the dispatcher
+TEST_CASE("C++ parse an invalid frame (too short)", "[cpp]") {
+    uint8_t raw_frame[] = {
+        0x06,       // Length (6 bytes)
+        0x41, 0x88, // FCF: Short addresses, header truncated
+        0xdb,       // Sequence Number
+        0xe7,       // Truncated Dest PAN ID
+        0x00        // Trailing 0x00
+    };
+    ieee802154_frame_t frame = {};
+
+    TEST_ASSERT_FALSE(ieee802154::DefaultCodec::parse(raw_frame, &frame));
+}
+
+// Test case: Build a frame through the dispatcher
+TEST_CASE("C++ build a frame", "[cpp]") {
+    uint8_t buffer[128];
+    uint8_t expected[128];
+    uint8_t payload[] = {0x44, 0x55, 0x66};
+    ieee802154_frame_t tx_frame = {};
+    tx_frame.fcf.frameType = IEEE802154_FRAME_TYPE_DATA;
+    tx_frame.fcf.ackRequest = 1;
+    tx_frame.fcf.panIdCompression = 1;
+    tx_frame.fcf.destAddrMode = IEEE802154_ADDR_MODE_SHORT;
+    tx_frame.fcf.frameVersion = IEEE802154_VERSION_2006;
+    tx_frame.fcf.srcAddrMode = IEEE802154_ADDR_MODE_EXTENDED;
+    tx_frame.sequenceNumber = 0x02;
+    tx_frame.destPanId = 0x1234;
+    tx_frame.destAddress[0] = 0x56;
+    tx_frame.destAddress[1] = 0x78;
+    for (int i = 0; i < IEEE802154_MAX_ADDR_LEN; i++) {
+        tx_frame.srcAddress[i] = 0xa0 + i;
+    }
+    tx_frame.payloadLen = sizeof(payload);
+    tx_frame.payload = payload;
+
+    size_t len = ieee802154::DefaultCodec::build(&tx_frame, buffer);
+    size_t expected_len = ieee802154_frame_build(&tx_frame, expected, false);
+    // Length(1) + FCF(2) + Seq(1) + DestPAN(2) + DestAddr(2) + SrcAddr(8) + Payload(3) + 0x00(1)
+    TEST_ASSERT_EQUAL(20, len);
+    TEST_ASSERT_EQUAL(expected_len, len);
+    ESP_LOG_BUFFER_HEX_LEVEL("DUMP", buffer, len, ESP_LOG_INFO);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, len);
+}